@@ -0,0 +1,50 @@
+#ifndef _EXPRESSION_HPP_
+#define _EXPRESSION_HPP_
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "number.hpp"
+
+namespace BT {
+
+/**
+ * The width of number used by the calculator. Twenty trits can represent
+ * values up to ±1,743,392,200, the widest range of any number whose int32_t
+ * conversion (used when rendering a result) is always exact.
+ */
+constexpr size_t CALC_WIDTH = 20;
+using CalcNumber = Number<CALC_WIDTH>;
+
+/**
+ * The outcome of evaluating a single expression. Exactly one of the value
+ * or the error message is provided.
+ */
+struct Evaluation {
+    std::optional<CalcNumber> value{};
+    std::string error{};
+};
+
+/**
+ * Parse and evaluate an arithmetic expression of balanced ternary numbers.
+ * Numbers are written with the usual '-', '0' and '+' notation and tokens
+ * are separated by whitespace; as '+' and '-' are both trits and operators,
+ * a token is read as an operator only where an operator is expected. The
+ * operators +, -, * and / are supported with the usual precedence, and
+ * parentheses may be used for grouping.
+ *
+ * Rather than exiting the program, dividing by zero is reported as an error
+ * for that expression, as are malformed expressions, parentheses nested
+ * more than 256 deep and numbers with more trits than a CalcNumber can hold. Overflows are not detected and wrap in
+ * the same way as for any other Number.
+ *
+ * @param expression The text of the expression to evaluate, e.g. "+- * (+0 - -)"
+ * @return The value of the expression, or a description of why it could
+ * not be evaluated
+ */
+auto evaluateExpression(std::string_view expression) -> Evaluation;
+
+}
+
+#endif
@@ -3,11 +3,15 @@
 
 #include <algorithm>
 #include <array>
+#include <compare>
+#include <cstdlib>
+#include <iostream>
 #include <ostream>
 #include <ranges>
 #include <string_view>
 
 #include "trit.hpp"
+#include "trit_span.hpp"
 
 namespace BT {
 
@@ -17,8 +21,10 @@ namespace BT {
  * "Balanced Ternary", a system where each trit can be "-1", "0" or "+1".
  * 
  * This is a templated class to allow the user to specify the number of trits
- * to use for the number. All binary operations only support operating on
- * numbers that share the same size.
+ * to use for the number. Member binary operations only support operating on
+ * numbers that share the same size; addition, subtraction and comparison
+ * between numbers of differing sizes are provided as free functions that
+ * operate through a TritSpan view of the narrower number.
  * 
  * @tparam N The number of trits to use in the number.
  */
@@ -43,6 +49,32 @@ public:
      */
     explicit constexpr Number(std::string_view encoded);
 
+    /**
+     * Construct a new Ternary Number with the value viewed by the supplied
+     * span. If the span is shorter than the templated length then the
+     * number is left-padded with zero-trits, which in balanced ternary is
+     * all that is needed to widen a value of either sign. If it is longer
+     * then it is truncated and only the N least significant trits are used.
+     * 
+     * @param trits A view of the trits to initialise the ternary number with
+     */
+    explicit Number(TritSpan trits);
+
+    /**
+     * Provide a non-owning view over the trits of this number. The view is
+     * only valid for as long as this number exists, and will reflect any
+     * later changes made to it.
+     * 
+     * @return A span viewing all N trits of this number
+     */
+    auto view() const& -> TritSpan;
+
+    /**
+     * Views of temporary numbers are disallowed, as the span would dangle as
+     * soon as the temporary is destroyed.
+     */
+    auto view() const&& -> TritSpan = delete;
+
     /**
      * Determines if the submitted ternary number has the same value.
      * 
@@ -151,6 +183,17 @@ public:
      * @param rhs The number to add into this number
      */
     auto operator+=(const Number<N>& rhs);
+
+    /**
+     * In-place addition of the value viewed by a span into this number. The
+     * span may be of any length; a shorter span is read as though it were
+     * widened with zero-trits and a longer span is truncated to its N least
+     * significant trits. This may result in an overflow in the same way as
+     * adding a number of the same size.
+     * 
+     * @param rhs A view of the value to add into this number
+     */
+    auto operator+=(TritSpan rhs);
     
     /**
      * Return the result of subtracting another ternary number from this one.
@@ -173,6 +216,17 @@ public:
      * @param rhs The number to subtract from this number
      */
     auto operator-=(const Number<N>& rhs);
+
+    /**
+     * In-place subtraction of the value viewed by a span from this number.
+     * The span may be of any length; a shorter span is read as though it
+     * were widened with zero-trits and a longer span is truncated to its N
+     * least significant trits. The viewed trits are negated as they are
+     * read, so no negated copy of the span is made.
+     * 
+     * @param rhs A view of the value to subtract from this number
+     */
+    auto operator-=(TritSpan rhs);
     
     /**
      * Calculate the product of this ternary number multiplied with another
@@ -252,6 +306,9 @@ public:
 
     /**
      * The value of this number in traditional signed 32-bit representation.
+     * Numbers of up to 20 trits always fit; the value of a wider number that
+     * falls outside that range wraps around as unsigned 32-bit arithmetic
+     * would.
      * 
      * @return This number in signed 32-bit representation
      */
@@ -281,6 +338,64 @@ private:
     std::array<Trit, N> value{};
 };
 
+/**
+ * Determines if two ternary numbers of differing sizes have the same value.
+ * The narrower number is compared as though it had been widened, but no
+ * widened copy is made.
+ * 
+ * @tparam N The number of trits in the first number
+ * @tparam M The number of trits in the second number
+ * @param lhs A ternary number to compare
+ * @param rhs Another ternary number of a different size to compare against
+ * @return true if both numbers have the same value, false otherwise
+ */
+template <size_t N, size_t M> requires (N != M)
+auto operator==(const Number<N>& lhs, const Number<M>& rhs) -> bool;
+
+/**
+ * Orders two ternary numbers of differing sizes by their values. This also
+ * provides the <, <=, > and >= operators between numbers of differing sizes.
+ * 
+ * @tparam N The number of trits in the first number
+ * @tparam M The number of trits in the second number
+ * @param lhs A ternary number to compare
+ * @param rhs Another ternary number of a different size to compare against
+ * @return The ordering of the value of lhs relative to that of rhs
+ */
+template <size_t N, size_t M> requires (N != M)
+auto operator<=>(const Number<N>& lhs, const Number<M>& rhs) -> std::strong_ordering;
+
+/**
+ * Sum two ternary numbers of differing sizes. The result takes the size of
+ * the wider number, and the narrower number is added through a view of its
+ * trits rather than first being copied into a wider temporary. This may
+ * result in an overflow if the sum requires more trits than the wider size.
+ * 
+ * @tparam N The number of trits in the first number
+ * @tparam M The number of trits in the second number
+ * @param lhs A ternary number to add
+ * @param rhs Another ternary number of a different size to add
+ * @return The sum of the two numbers, sized to the wider of the two
+ */
+template <size_t N, size_t M> requires (N != M)
+auto operator+(const Number<N>& lhs, const Number<M>& rhs) -> Number<std::max(N, M)>;
+
+/**
+ * Subtract a ternary number from another of a differing size. The result
+ * takes the size of the wider number, and the subtrahend is negated as its
+ * trits are read through a view rather than first being copied. This may
+ * result in an underflow if the difference requires more trits than the
+ * wider size.
+ * 
+ * @tparam N The number of trits in the first number
+ * @tparam M The number of trits in the second number
+ * @param lhs The ternary number to subtract from
+ * @param rhs A ternary number of a different size to subtract
+ * @return The difference of the two numbers, sized to the wider of the two
+ */
+template <size_t N, size_t M> requires (N != M)
+auto operator-(const Number<N>& lhs, const Number<M>& rhs) -> Number<std::max(N, M)>;
+
 // As a fully templated class we can't use a separate translation unit
 // compiled from a .cpp file; all our member function definitions have
 // to be inline. This means we could have all of the definitions here
@@ -15,8 +15,21 @@ template <size_t N>
 constexpr BT::Number<N>::Number(std::string_view encoded) {
     size_t length = std::min(N, encoded.size());
 
-    // Populate lowest N trits with decoded characters
-    std::ranges::transform(encoded, std::next(value.begin(), N-length), tritFromEncoded);
+    // Populate lowest N trits with the N right-most decoded characters
+    std::ranges::transform(encoded.substr(encoded.size() - length), std::next(value.begin(), N-length), tritFromEncoded);
+}
+
+template <size_t N>
+BT::Number<N>::Number(TritSpan trits) {
+    // Truncate to the lowest N trits and copy them into the lowest positions,
+    // leaving any higher positions as zero-trits to widen the value
+    auto lowest = trits.lowest(N).trits();
+    std::ranges::copy(lowest, std::next(value.begin(), N - lowest.size()));
+}
+
+template <size_t N>
+auto BT::Number<N>::view() const& -> TritSpan {
+    return TritSpan{value};
 }
 
 template <size_t N>
@@ -146,6 +159,19 @@ auto BT::Number<N>::operator+=(const Number<N>& rhs) {
     );
 }
 
+template <size_t N>
+auto BT::Number<N>::operator+=(TritSpan rhs) {
+    // Walk our trits from least to most significant alongside the matching
+    // positions of the span, which reads as zero-trits beyond its length.
+    // Trits of the span above our own length are simply never visited.
+    SumResult sumResult{};
+    size_t position = 0;
+    for (auto it = value.rbegin(); it != value.rend(); ++it, ++position) {
+        sumResult = addTrits(*it, rhs.tritAt(position), sumResult.carry);
+        *it = sumResult.result;
+    }
+}
+
 template <size_t N>
 auto BT::Number<N>::operator-(const Number<N>& rhs) const -> Number<N> {
     return *this + (-rhs);
@@ -156,6 +182,18 @@ auto BT::Number<N>::operator-=(const Number<N>& rhs) {
     *this += (-rhs);
 }
 
+template <size_t N>
+auto BT::Number<N>::operator-=(TritSpan rhs) {
+    // As for in-place addition of a span, but negating each of its trits as
+    // they are read rather than building a negated copy first
+    SumResult sumResult{};
+    size_t position = 0;
+    for (auto it = value.rbegin(); it != value.rend(); ++it, ++position) {
+        sumResult = addTrits(*it, negateTrit(rhs.tritAt(position)), sumResult.carry);
+        *it = sumResult.result;
+    }
+}
+
 template <size_t N>
 auto BT::Number<N>::operator*(const Number<N>& rhs) const -> Number<N> {
     Number<N> out;
@@ -195,13 +233,13 @@ auto BT::Number<N>::operator/(const Number<N>& divisor) const -> Number<N> {
         std::exit(EXIT_FAILURE);
     }
 
-    // Integer division implemented with a repeated subtraction approach. We
-    // convert numerator and divisor to positive to perform the division, and
-    // then decide whether to flip the result based on if they originally had
+    // Integer division implemented as trit-wise long division. We convert
+    // numerator and divisor to positive to perform the division, and then
+    // decide whether to flip the result based on if they originally had
     // different signs.
 
     bool numerator_is_negative = (*this) < ZERO;
-    auto abs_remainder = numerator_is_negative
+    const auto abs_numerator = numerator_is_negative
         ? -(*this)
         : (*this);
 
@@ -210,10 +248,35 @@ auto BT::Number<N>::operator/(const Number<N>& divisor) const -> Number<N> {
         ? -divisor
         : divisor;
 
+    // Bring down one numerator trit at a time from the most significant,
+    // keeping the running remainder in [0, divisor). Tripling the remainder
+    // and adding the next trit can exceed N trits for a large divisor, so the
+    // remainder is held one trit wider and compared against the divisor
+    // through mixed-width operations. Even a positive numerator can contain
+    // negative trits, so the remainder can briefly dip to -1, giving a
+    // quotient trit of -1; otherwise it is at most 3 * divisor - 2, giving a
+    // quotient "trit" of up to 2. Since 3 * quotient + q is computed with
+    // ordinary carrying arithmetic this isn't a problem.
+    BT::Number<N + 1> remainder;
     BT::Number<N> quotient = ZERO;
-    while (abs_remainder >= abs_divisor) {
-        abs_remainder -= abs_divisor;
-        ++quotient;
+    for (Trit trit : abs_numerator.value) {
+        remainder <<= 1;
+        quotient <<= 1;
+
+        if (trit == Trit::POS) {
+            ++remainder;
+        } else if (trit == Trit::NEG) {
+            --remainder;
+        }
+
+        if (remainder < BT::Number<N + 1>::ZERO) {
+            remainder += abs_divisor.view();
+            --quotient;
+        }
+        while (remainder >= abs_divisor) {
+            remainder -= abs_divisor.view();
+            ++quotient;
+        }
     }
 
     return (numerator_is_negative ^ divisor_is_negative)
@@ -263,27 +326,33 @@ auto BT::Number<N>::operator<<=(size_t positions) {
 
 template <size_t N>
 BT::Number<N>::operator int32_t() const {
-    int32_t result = 0;
-
-    // Without a useful enumerate() function (or way to elegantly zip collection
-    // elements with std::iota()) we use multiple initialisation and update to
-    // track an iterator to the current trit (right-to-left) as well as the
-    // absolute value of that position (tripling for each index). We add or
-    // subtract that value (or do nothing) based on the trit encountered. With
-    // an enumerate() iterator adaptor we could instead calculate the value with
-    // pow(3, idx), perhaps more wastefully depending on compiler optimisation.
-    // We could also technically determine our index in-loop with std::distance
-    // but somehow this seems more wasteful even though for an std::array with
-    // a random-access iterator the calculation of distance is O(1).
-    for (auto val = 1, it = value.rbegin(); it != value.rend(); val*=3, ++it) {
-        if (*it == Trit::POS) {
-            result += val;
-        } else if (*it == Trit::NEG) {
-            result -= val;
-        }
-    }
+    return static_cast<int32_t>(view());
+}
 
-    return result;
+template <size_t N, size_t M> requires (N != M)
+auto operator==(const BT::Number<N>& lhs, const BT::Number<M>& rhs) -> bool {
+    return lhs.view() == rhs.view();
+}
+
+template <size_t N, size_t M> requires (N != M)
+auto operator<=>(const BT::Number<N>& lhs, const BT::Number<M>& rhs) -> std::strong_ordering {
+    return lhs.view() <=> rhs.view();
+}
+
+template <size_t N, size_t M> requires (N != M)
+auto operator+(const BT::Number<N>& lhs, const BT::Number<M>& rhs) -> BT::Number<std::max(N, M)> {
+    // The result has to be stored somewhere, so widening the lhs into it is
+    // the only copy made. The rhs is then added straight from its own trits.
+    BT::Number<std::max(N, M)> out{lhs.view()};
+    out += rhs.view();
+    return out;
+}
+
+template <size_t N, size_t M> requires (N != M)
+auto operator-(const BT::Number<N>& lhs, const BT::Number<M>& rhs) -> BT::Number<std::max(N, M)> {
+    BT::Number<std::max(N, M)> out{lhs.view()};
+    out -= rhs.view();
+    return out;
 }
 
 template <size_t M>
@@ -0,0 +1,124 @@
+#ifndef _PIPELINE_HPP_
+#define _PIPELINE_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace BT {
+
+/**
+ * A blocking first-in-first-out queue with a fixed capacity. Producers wait
+ * while the queue is full, which stops a reader from racing ahead of the
+ * consumers and holding a whole input stream in memory.
+ *
+ * @tparam T The type of item held in the queue
+ */
+template <typename T>
+class BoundedQueue {
+public:
+    /**
+     * Construct an empty queue that holds at most the specified number of
+     * items at once.
+     *
+     * @param capacity The maximum number of items held in the queue
+     */
+    explicit BoundedQueue(size_t capacity);
+
+    /**
+     * Add an item to the back of the queue, waiting for space if it is full.
+     *
+     * @param item The item to add to the queue
+     */
+    auto push(T item) -> void;
+
+    /**
+     * Remove the item at the front of the queue, waiting for one to arrive
+     * if the queue is empty.
+     *
+     * @return The front item, or nothing once the queue is empty and closed
+     */
+    auto pop() -> std::optional<T>;
+
+    /**
+     * Signal that no further items will be pushed, releasing any consumers
+     * waiting on an empty queue. Items already in the queue can still be
+     * popped.
+     */
+    auto close() -> void;
+
+private:
+    const size_t capacity;
+    std::queue<T> items{};
+    bool closed = false;
+    std::mutex mutex{};
+    std::condition_variable not_full{};
+    std::condition_variable not_empty{};
+};
+
+/**
+ * Collects the results of numbered batches as they are completed, in
+ * whatever order that happens, and hands them back strictly in batch order.
+ * Batches that complete too far ahead of the next one to be handed back are
+ * held back, so a single slow batch cannot cause results to pile up without
+ * bound.
+ */
+class Sequencer {
+public:
+    /**
+     * Construct a sequencer that accepts batches up to the specified number
+     * of positions ahead of the next batch to be handed back. A window of at
+     * least one always allows the next batch itself to be submitted.
+     *
+     * @param window The number of batches that may be held at once
+     */
+    explicit Sequencer(size_t window);
+
+    /**
+     * Provide the results of a completed batch, waiting if it is too far
+     * ahead of the next batch to be handed back.
+     *
+     * @param index The position of the batch in the stream, from zero
+     * @param results The results of the batch
+     */
+    auto submit(size_t index, std::vector<std::string> results) -> void;
+
+    /**
+     * Record how many batches the stream was split into, once it has been
+     * read to the end.
+     *
+     * @param batch_count The total number of batches that will be submitted
+     */
+    auto finish(size_t batch_count) -> void;
+
+    /**
+     * Wait for the results of the next batch in order.
+     *
+     * @return The results of the next batch, or nothing once every batch has
+     * been handed back
+     */
+    auto next() -> std::optional<std::vector<std::string>>;
+
+private:
+    const size_t window;
+    std::map<size_t, std::vector<std::string>> completed{};
+    size_t next_index = 0;
+    std::optional<size_t> total{};
+    std::mutex mutex{};
+    std::condition_variable has_room{};
+    std::condition_variable has_next{};
+};
+
+// As with Number, the definitions for the templated queue live in a separate
+// template-implementation file that is included here.
+#include "pipeline.tpp"
+
+}
+
+#endif
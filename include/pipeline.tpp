@@ -0,0 +1,40 @@
+#ifndef _PIPELINE_TPP_
+#define _PIPELINE_TPP_
+
+#ifndef _PIPELINE_HPP_
+#error __FILE__ should only be included from pipeline.hpp
+#endif
+
+template <typename T>
+BT::BoundedQueue<T>::BoundedQueue(size_t capacity): capacity{capacity} { }
+
+template <typename T>
+auto BT::BoundedQueue<T>::push(T item) -> void {
+    std::unique_lock lock{mutex};
+    not_full.wait(lock, [this] { return items.size() < capacity; });
+    items.push(std::move(item));
+    not_empty.notify_one();
+}
+
+template <typename T>
+auto BT::BoundedQueue<T>::pop() -> std::optional<T> {
+    std::unique_lock lock{mutex};
+    not_empty.wait(lock, [this] { return !items.empty() || closed; });
+    if (items.empty()) {
+        return std::nullopt;
+    }
+
+    T item = std::move(items.front());
+    items.pop();
+    not_full.notify_one();
+    return item;
+}
+
+template <typename T>
+auto BT::BoundedQueue<T>::close() -> void {
+    std::lock_guard lock{mutex};
+    closed = true;
+    not_empty.notify_all();
+}
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef _TRIT_SPAN_HPP_
+#define _TRIT_SPAN_HPP_
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "trit.hpp"
+
+namespace BT {
+
+/**
+ * A non-owning, read-only view over a contiguous sequence of trits. Trits
+ * are stored most-significant first, matching the layout of a ternary
+ * Number, so a span can view either a whole number or just a field of it.
+ *
+ * Unlike two's complement binary, balanced ternary needs no sign extension;
+ * a value is widened simply by treating every trit beyond the viewed ones
+ * as a zero-trit. A span of any length can therefore be read as though it
+ * were any wider width without copying, and all comparisons between spans
+ * are by value regardless of their lengths.
+ *
+ * As a view, a span is only valid for as long as the trits it refers to.
+ */
+class TritSpan {
+public:
+    /**
+     * Construct an empty span, which views no trits and has a value of zero.
+     */
+    constexpr TritSpan() = default;
+
+    /**
+     * Construct a span viewing the supplied contiguous trits, which are
+     * expected to be ordered most-significant first.
+     *
+     * @param trits The trits to view
+     */
+    explicit constexpr TritSpan(std::span<const Trit> trits): viewed{trits} { }
+
+    /**
+     * The number of trits viewed by this span.
+     *
+     * @return The length of this span in trits
+     */
+    auto size() const -> size_t;
+
+    /**
+     * Retrieve the trit at the specified position, where position zero is
+     * the least significant trit. Positions beyond the length of the span
+     * are zero-trits, which is all that is required to widen a balanced
+     * ternary value.
+     *
+     * @param position The significance of the trit to retrieve
+     * @return The trit at that position, or the zero trit if the position
+     * lies beyond the end of the span
+     */
+    auto tritAt(size_t position) const -> Trit;
+
+    /**
+     * Truncate this span to only its least significant trits. If the count
+     * is not less than the length of the span then the whole span is
+     * returned.
+     *
+     * @param count The number of least significant trits to keep
+     * @return A span over the lowest count trits of this span
+     */
+    auto lowest(size_t count) const -> TritSpan;
+
+    /**
+     * Extract a field of trits from this span. The field begins at the
+     * specified position (where position zero is the least significant
+     * trit) and extends towards the more significant trits. Any part of the
+     * field lying beyond the end of the span is clipped.
+     *
+     * @param position The significance of the lowest trit in the field
+     * @param count The number of trits in the field
+     * @return A span over the requested field of this span
+     */
+    auto slice(size_t position, size_t count) const -> TritSpan;
+
+    /**
+     * The viewed trits themselves, most-significant first.
+     *
+     * @return The underlying trits of this span
+     */
+    auto trits() const -> std::span<const Trit>;
+
+    /**
+     * The value of the viewed trits in traditional signed 32-bit
+     * representation. Spans of up to 20 trits always fit; the value of a
+     * longer span that falls outside that range wraps around as unsigned
+     * 32-bit arithmetic would.
+     *
+     * @return The viewed value in signed 32-bit representation
+     */
+    explicit operator int32_t() const;
+
+private:
+    std::span<const Trit> viewed{};
+};
+
+/**
+ * Determines if two spans view the same value. Spans of differing
+ * lengths are compared as though the shorter span were widened with
+ * zero-trits.
+ *
+ * @param lhs A span to compare
+ * @param rhs Another span to compare against
+ * @return true if both spans view the same value, false otherwise
+ */
+auto operator==(TritSpan lhs, TritSpan rhs) -> bool;
+
+/**
+ * Orders two spans by the values they view. Spans of differing lengths
+ * are compared as though the shorter span were widened with zero-trits.
+ *
+ * @param lhs A span to compare
+ * @param rhs Another span to compare against
+ * @return The ordering of the value of lhs relative to that of rhs
+ */
+auto operator<=>(TritSpan lhs, TritSpan rhs) -> std::strong_ordering;
+
+}
+
+#endif
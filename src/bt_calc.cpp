@@ -0,0 +1,210 @@
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "expression.hpp"
+#include "pipeline.hpp"
+
+namespace {
+
+/**
+ * A run of consecutive input lines, tagged with its position in the stream
+ * so that results can be written back out in the original order.
+ */
+struct Batch {
+    size_t index{};
+    std::vector<std::string> lines{};
+};
+
+// Upper bounds on the tunables, as queue and sequencer capacities are derived
+// from the thread count and a batch is held in memory in its entirety
+constexpr size_t MAX_THREADS = 256;
+constexpr size_t MAX_BATCH_SIZE = 65536;
+
+struct Options {
+    size_t threads = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, MAX_THREADS);
+    size_t batch_size = 256;
+    bool throughput = false;
+    std::optional<std::string> input_path{};
+};
+
+auto printUsage(std::ostream& os) {
+    os << "Usage: bt-calc [--threads N] [--batch-size N] [--throughput] [FILE]\n"
+       << "\n"
+       << "Evaluates one balanced ternary expression per line of FILE, or of\n"
+       << "standard input if no file is given, writing one result per line in\n"
+       << "the original order.\n"
+       << "\n"
+       << "  --threads N     Number of worker threads, up to 256 (default: hardware concurrency)\n"
+       << "  --batch-size N  Number of lines handed to a worker at a time, up to 65536 (default: 256)\n"
+       << "  --throughput    Report expressions evaluated per second to standard error\n";
+}
+
+auto parseCount(std::string_view text, size_t max) -> std::optional<size_t> {
+    // Only plain digits are accepted; a leading sign is rejected outright
+    // rather than risking "-1" wrapping around to a huge unsigned value
+    if (text.empty() || !std::isdigit(static_cast<unsigned char>(text.front()))) {
+        return std::nullopt;
+    }
+
+    size_t count = 0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), count);
+    if (error != std::errc{} || end != text.data() + text.size() || count == 0 || count > max) {
+        return std::nullopt;
+    }
+    return count;
+}
+
+auto parseOptions(int argc, char* argv[]) -> std::optional<Options> {
+    Options options;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg{argv[i]};
+
+        if (arg == "--threads" || arg == "--batch-size") {
+            const size_t max = (arg == "--threads") ? MAX_THREADS : MAX_BATCH_SIZE;
+            const auto count = (i + 1 < argc) ? parseCount(argv[++i], max) : std::nullopt;
+            if (!count) {
+                std::cerr << "bt-calc: " << arg << " requires an integer from 1 to " << max << std::endl;
+                return std::nullopt;
+            }
+            (arg == "--threads" ? options.threads : options.batch_size) = *count;
+        } else if (arg == "--throughput") {
+            options.throughput = true;
+        } else if (arg.starts_with("-") && arg != "-") {
+            std::cerr << "bt-calc: unknown option " << arg << std::endl;
+            return std::nullopt;
+        } else if (options.input_path) {
+            std::cerr << "bt-calc: only one input file may be given" << std::endl;
+            return std::nullopt;
+        } else if (arg != "-") {
+            options.input_path = std::string{arg};
+        }
+    }
+
+    return options;
+}
+
+/**
+ * Render the outcome of evaluating a single line. Blank lines are passed
+ * through unchanged so that output lines always match up with input lines.
+ */
+auto renderLine(const std::string& line, size_t& evaluated) -> std::string {
+    if (std::ranges::all_of(line, [](unsigned char c) { return std::isspace(c); })) {
+        return "";
+    }
+
+    ++evaluated;
+    const auto evaluation = BT::evaluateExpression(line);
+    if (!evaluation.value) {
+        return "error: " + evaluation.error;
+    }
+
+    std::ostringstream rendered;
+    rendered << *evaluation.value;
+    return rendered.str();
+}
+
+}
+
+auto main(int argc, char* argv[]) -> int {
+    const auto options = parseOptions(argc, argv);
+    if (!options) {
+        printUsage(std::cerr);
+        return EXIT_FAILURE;
+    }
+
+    std::ifstream file;
+    if (options->input_path) {
+        file.open(*options->input_path);
+        if (!file) {
+            std::cerr << "bt-calc: cannot open " << *options->input_path << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    std::istream& input = options->input_path ? file : std::cin;
+
+    // Enough queued batches to keep every worker busy while the reader refills
+    // the queue, and enough room in the sequencer for every batch in flight
+    BT::BoundedQueue<Batch> queue{2 * options->threads};
+    BT::Sequencer sequencer{3 * options->threads};
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::jthread reader{[&] {
+        size_t batch_count = 0;
+        Batch batch{.index = batch_count};
+        for (std::string line; std::getline(input, line); ) {
+            batch.lines.push_back(std::move(line));
+            if (batch.lines.size() == options->batch_size) {
+                queue.push(std::move(batch));
+                batch = Batch{.index = ++batch_count};
+            }
+        }
+        if (!batch.lines.empty()) {
+            queue.push(std::move(batch));
+            ++batch_count;
+        }
+
+        queue.close();
+        sequencer.finish(batch_count);
+    }};
+
+    // Each worker counts its own expressions in a local, publishing the count
+    // only once the queue is drained so that workers never write to shared
+    // cache lines per expression. The counts are summed once all have joined.
+    std::vector<size_t> evaluated(options->threads, 0);
+    std::vector<std::jthread> workers;
+    for (size_t worker = 0; worker < options->threads; ++worker) {
+        workers.emplace_back([&, worker] {
+            size_t worker_evaluated = 0;
+            while (auto batch = queue.pop()) {
+                std::vector<std::string> results;
+                results.reserve(batch->lines.size());
+                for (const auto& line : batch->lines) {
+                    results.push_back(renderLine(line, worker_evaluated));
+                }
+                sequencer.submit(batch->index, std::move(results));
+            }
+            evaluated[worker] = worker_evaluated;
+        });
+    }
+
+    // Results are written from this thread as soon as they are next in order
+    while (auto results = sequencer.next()) {
+        for (const auto& result : *results) {
+            std::cout << result << '\n';
+        }
+    }
+    std::cout.flush();
+
+    reader.join();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (options->throughput) {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        size_t total = 0;
+        for (size_t count : evaluated) {
+            total += count;
+        }
+
+        std::cerr << "bt-calc: " << total << " expressions in " << elapsed.count() << " s ("
+                  << static_cast<double>(total) / elapsed.count() << " expressions/s, "
+                  << options->threads << " threads, batch size " << options->batch_size << ")"
+                  << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
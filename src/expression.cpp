@@ -0,0 +1,166 @@
+#include "expression.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * Split an expression into whitespace-separated tokens. Parentheses are
+ * always tokens of their own, as they can never form part of a number.
+ */
+auto tokenise(std::string_view expression) -> std::vector<std::string_view> {
+    std::vector<std::string_view> tokens;
+
+    size_t pos = 0;
+    while (pos < expression.size()) {
+        const char c = expression[pos];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++pos;
+        } else if (c == '(' || c == ')') {
+            tokens.push_back(expression.substr(pos, 1));
+            ++pos;
+        } else {
+            const size_t start = pos;
+            while (pos < expression.size()
+                && !std::isspace(static_cast<unsigned char>(expression[pos]))
+                && expression[pos] != '('
+                && expression[pos] != ')') {
+                ++pos;
+            }
+            tokens.push_back(expression.substr(start, pos - start));
+        }
+    }
+
+    return tokens;
+}
+
+/**
+ * A recursive-descent parser that evaluates as it parses. Each parsing
+ * function returns an empty optional once an error has been recorded, and
+ * callers simply propagate that upwards.
+ */
+class Parser {
+public:
+    explicit Parser(std::vector<std::string_view> tokens): tokens{std::move(tokens)} { }
+
+    auto evaluate() -> BT::Evaluation {
+        if (tokens.empty()) {
+            return {.error = "empty expression"};
+        }
+
+        auto value = parseExpression();
+        if (value && pos != tokens.size()) {
+            fail("unexpected '" + std::string{tokens[pos]} + "'");
+            value.reset();
+        }
+
+        return {.value = value, .error = error};
+    }
+
+private:
+    // expression := term (('+' | '-') term)*
+    auto parseExpression() -> std::optional<BT::CalcNumber> {
+        auto lhs = parseTerm();
+        while (lhs && (peek("+") || peek("-"))) {
+            const bool is_sum = tokens[pos++] == "+";
+            const auto rhs = parseTerm();
+            if (!rhs) {
+                return std::nullopt;
+            }
+            if (is_sum) {
+                *lhs += *rhs;
+            } else {
+                *lhs -= *rhs;
+            }
+        }
+        return lhs;
+    }
+
+    // term := factor (('*' | '/') factor)*
+    auto parseTerm() -> std::optional<BT::CalcNumber> {
+        auto lhs = parseFactor();
+        while (lhs && (peek("*") || peek("/"))) {
+            const bool is_product = tokens[pos++] == "*";
+            const auto rhs = parseFactor();
+            if (!rhs) {
+                return std::nullopt;
+            }
+
+            if (is_product) {
+                *lhs *= *rhs;
+            } else if (*rhs == BT::CalcNumber::ZERO) {
+                // Number division exits the program on a zero divisor, which
+                // would take every other expression in the stream down with it
+                return fail("division by zero");
+            } else {
+                *lhs /= *rhs;
+            }
+        }
+        return lhs;
+    }
+
+    // factor := number | '(' expression ')'
+    auto parseFactor() -> std::optional<BT::CalcNumber> {
+        if (pos == tokens.size()) {
+            return fail("expected a number");
+        }
+
+        if (peek("(")) {
+            // Each level of parentheses recurses through every parsing
+            // function, so bound the depth rather than let one line exhaust
+            // the stack and take the whole calculator down with it
+            if (depth == MAX_DEPTH) {
+                return fail("expression nested too deeply");
+            }
+
+            ++pos;
+            ++depth;
+            auto value = parseExpression();
+            --depth;
+            if (value && !peek(")")) {
+                return fail("expected ')'");
+            }
+            ++pos;
+            return value;
+        }
+
+        const auto token = tokens[pos];
+        if (!std::ranges::all_of(token, [](char c) { return c == '-' || c == '0' || c == '+'; })) {
+            return fail("invalid number '" + std::string{token} + "'");
+        }
+
+        // Leading zero-trits don't count towards the width of a number
+        const auto significant = token.substr(std::min(token.find_first_not_of('0'), token.size()));
+        if (significant.size() > BT::CALC_WIDTH) {
+            return fail("number '" + std::string{token} + "' has too many trits");
+        }
+
+        ++pos;
+        return BT::CalcNumber{significant};
+    }
+
+    auto peek(std::string_view expected) const -> bool {
+        return pos < tokens.size() && tokens[pos] == expected;
+    }
+
+    auto fail(std::string message) -> std::optional<BT::CalcNumber> {
+        error = std::move(message);
+        return std::nullopt;
+    }
+
+    static constexpr size_t MAX_DEPTH = 256;
+
+    std::vector<std::string_view> tokens;
+    size_t pos = 0;
+    size_t depth = 0;
+    std::string error{};
+};
+
+}
+
+auto BT::evaluateExpression(std::string_view expression) -> Evaluation {
+    return Parser{tokenise(expression)}.evaluate();
+}
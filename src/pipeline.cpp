@@ -0,0 +1,34 @@
+#include "pipeline.hpp"
+
+BT::Sequencer::Sequencer(size_t window): window{window} { }
+
+auto BT::Sequencer::submit(size_t index, std::vector<std::string> results) -> void {
+    std::unique_lock lock{mutex};
+    has_room.wait(lock, [this, index] { return index < next_index + window; });
+    completed.emplace(index, std::move(results));
+    has_next.notify_one();
+}
+
+auto BT::Sequencer::finish(size_t batch_count) -> void {
+    std::lock_guard lock{mutex};
+    total = batch_count;
+    has_next.notify_one();
+}
+
+auto BT::Sequencer::next() -> std::optional<std::vector<std::string>> {
+    std::unique_lock lock{mutex};
+    has_next.wait(lock, [this] {
+        return completed.contains(next_index) || (total && next_index == *total);
+    });
+
+    auto it = completed.find(next_index);
+    if (it == completed.end()) {
+        return std::nullopt;
+    }
+
+    auto results = std::move(it->second);
+    completed.erase(it);
+    ++next_index;
+    has_room.notify_all();
+    return results;
+}
@@ -0,0 +1,68 @@
+#include "trit_span.hpp"
+
+#include <algorithm>
+
+auto BT::TritSpan::size() const -> size_t {
+    return viewed.size();
+}
+
+auto BT::TritSpan::tritAt(size_t position) const -> Trit {
+    // Trits are stored most-significant first, so position zero is the
+    // last element. Anything beyond the viewed trits is an implicit zero.
+    return position < viewed.size()
+        ? viewed[viewed.size() - 1 - position]
+        : Trit::ZERO;
+}
+
+auto BT::TritSpan::lowest(size_t count) const -> TritSpan {
+    return TritSpan{viewed.last(std::min(count, viewed.size()))};
+}
+
+auto BT::TritSpan::slice(size_t position, size_t count) const -> TritSpan {
+    if (position >= viewed.size()) {
+        return TritSpan{};
+    }
+
+    // Drop the trits below the field, then keep only as many of the
+    // remaining lowest trits as the field (or the span) allows
+    return TritSpan{viewed.first(viewed.size() - position)}.lowest(count);
+}
+
+auto BT::TritSpan::trits() const -> std::span<const Trit> {
+    return viewed;
+}
+
+BT::TritSpan::operator int32_t() const {
+    // Horner's method from the most significant trit, so that we never
+    // multiply past the final trit. Accumulating unsigned makes any wrap for
+    // an out-of-range value well-defined, and the conversion back to signed
+    // is modular.
+    uint32_t result = 0;
+    for (Trit trit : viewed) {
+        result *= 3;
+        if (trit == Trit::POS) {
+            ++result;
+        } else if (trit == Trit::NEG) {
+            --result;
+        }
+    }
+
+    return static_cast<int32_t>(result);
+}
+
+auto BT::operator==(TritSpan lhs, TritSpan rhs) -> bool {
+    return (lhs <=> rhs) == std::strong_ordering::equal;
+}
+
+auto BT::operator<=>(TritSpan lhs, TritSpan rhs) -> std::strong_ordering {
+    // As with a full Number the comparison is lexicographical from the most
+    // significant trit, but we start from the width of the longer span and
+    // let the shorter one read as zero-trits until its own length is reached.
+    for (size_t position = std::max(lhs.size(), rhs.size()); position-- > 0; ) {
+        if (auto ordering = lhs.tritAt(position) <=> rhs.tritAt(position); ordering != 0) {
+            return ordering;
+        }
+    }
+
+    return std::strong_ordering::equal;
+}
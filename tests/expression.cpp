@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include "expression.hpp"
+
+#include <string>
+
+TEST(Expression, SingleNumber) {
+    const auto evaluation = BT::evaluateExpression("+-0--");
+
+    ASSERT_TRUE(evaluation.value);
+    EXPECT_EQ(*evaluation.value, BT::CalcNumber{"+-0--"}); // 50
+}
+
+TEST(Expression, LeadingZeroTritsBeyondWidth) {
+    // Leading zero-trits don't count towards the 20-trit limit
+    const auto evaluation = BT::evaluateExpression("0000000000000000000000000000000+ + +");
+
+    ASSERT_TRUE(evaluation.value);
+    EXPECT_EQ(static_cast<int32_t>(*evaluation.value), 2);
+}
+
+TEST(Expression, TritsAndOperatorsDistinguishedByPosition) {
+    // "+ - +" is 1 - 1 rather than three numbers
+    const auto evaluation = BT::evaluateExpression("+ - +");
+
+    ASSERT_TRUE(evaluation.value);
+    EXPECT_EQ(*evaluation.value, BT::CalcNumber::ZERO);
+}
+
+TEST(Expression, OperatorPrecedence) {
+    // 23 + 33 * 2 = 89, not 112
+    const auto evaluation = BT::evaluateExpression("+0-- + ++-0 * +-");
+
+    ASSERT_TRUE(evaluation.value);
+    EXPECT_EQ(static_cast<int32_t>(*evaluation.value), 89);
+}
+
+TEST(Expression, Parentheses) {
+    // (23 + 33) * 2 = 112
+    const auto evaluation = BT::evaluateExpression("(+0-- + ++-0) * +-");
+
+    ASSERT_TRUE(evaluation.value);
+    EXPECT_EQ(static_cast<int32_t>(*evaluation.value), 112);
+}
+
+TEST(Expression, IntegerDivision) {
+    // 59 / -12 = -4, rounded towards zero
+    const auto evaluation = BT::evaluateExpression("+-+-- / --0");
+
+    ASSERT_TRUE(evaluation.value);
+    EXPECT_EQ(static_cast<int32_t>(*evaluation.value), -4);
+}
+
+TEST(Expression, ErrorsAreReportedNotFatal) {
+    EXPECT_EQ(BT::evaluateExpression("+-+ / 0").error, "division by zero");
+    EXPECT_EQ(BT::evaluateExpression("+-+ / (+ - +)").error, "division by zero");
+    EXPECT_EQ(BT::evaluateExpression("").error, "empty expression");
+    EXPECT_EQ(BT::evaluateExpression("+-2").error, "invalid number '+-2'");
+    EXPECT_EQ(BT::evaluateExpression("+ +-").error, "unexpected '+-'");
+    EXPECT_EQ(BT::evaluateExpression("+ *").error, "expected a number");
+    EXPECT_EQ(BT::evaluateExpression("(+ - -").error, "expected ')'");
+    EXPECT_EQ(
+        BT::evaluateExpression("+000000000000000000000").error,
+        "number '+000000000000000000000' has too many trits"
+    );
+
+    EXPECT_FALSE(BT::evaluateExpression("+-+ / 0").value);
+}
+
+TEST(Expression, FullWidthResults) {
+    // The largest 20-trit value converts exactly, and overflow wraps around
+    const auto largest = BT::evaluateExpression("++++++++++++++++++++");
+    ASSERT_TRUE(largest.value);
+    EXPECT_EQ(static_cast<int32_t>(*largest.value), 1743392200);
+
+    const auto wrapped = BT::evaluateExpression("++++++++++++++++++++ + +");
+    ASSERT_TRUE(wrapped.value);
+    EXPECT_EQ(static_cast<int32_t>(*wrapped.value), -1743392200);
+}
+
+TEST(Expression, NestingDepthIsBounded) {
+    const auto nested = [](size_t depth) {
+        return std::string(depth, '(') + "+" + std::string(depth, ')');
+    };
+
+    // Reasonable nesting is evaluated as normal
+    const auto shallow = BT::evaluateExpression(nested(100));
+    ASSERT_TRUE(shallow.value);
+    EXPECT_EQ(static_cast<int32_t>(*shallow.value), 1);
+
+    // Deep nesting is reported rather than exhausting the stack
+    EXPECT_EQ(BT::evaluateExpression(nested(100000)).error, "expression nested too deeply");
+}
@@ -3,6 +3,26 @@
 
 #include <cstdlib>
 #include <sstream>
+#include <utility>
+
+namespace {
+    // Whether a view can be taken of a number of the given value category
+    template <typename T>
+    concept Viewable = requires(T&& num) { std::forward<T>(num).view(); };
+
+    // Build a number by counting up or down from zero
+    template <size_t N>
+    auto fromInt(int32_t value) -> BT::Number<N> {
+        BT::Number<N> out;
+        for (; value > 0; --value) {
+            ++out;
+        }
+        for (; value < 0; ++value) {
+            --out;
+        }
+        return out;
+    }
+}
 
 TEST(Number, OutputRepresentation) {
     const BT::Number<8> num_50 {"+-0--"};
@@ -13,6 +33,12 @@ TEST(Number, OutputRepresentation) {
     EXPECT_EQ(repr.str(), "000+-0-- (50)");
 }
 
+TEST(Number, EncodedConstructionTruncates) {
+    // Only the N right-most characters are used
+    EXPECT_EQ(BT::Number<3>{"+0+-"}, BT::Number<3>{"0+-"});
+    EXPECT_EQ(BT::Number<3>{"000000+-"}, BT::Number<3>{"+-"});
+}
+
 TEST (Number, Comparisons) {
     const BT::Number<8>& num_0 = BT::Number<8>::ZERO;
     const BT::Number<8> num_17{"+-0-"};
@@ -211,4 +237,89 @@ TEST(Number, InPlaceBinaryOperations) {
     temp = num_23;
     temp *= num_33;
     EXPECT_EQ(temp, BT::Number<8>{"+00+0+0"}); // Product is 759
-}
\ No newline at end of file
+}
+
+TEST(Number, ViewsOfTemporariesAreDisallowed) {
+    static_assert(Viewable<BT::Number<8>&>);
+    static_assert(Viewable<const BT::Number<8>&>);
+    static_assert(!Viewable<BT::Number<8>>);
+    static_assert(!Viewable<const BT::Number<8>>);
+}
+
+TEST(Number, SpanConstruction) {
+    const BT::Number<8> num_neg_50{"-+0++"};
+
+    // Widening a negative number requires no sign extension
+    EXPECT_EQ(BT::Number<12>{num_neg_50.view()}, BT::Number<12>{"-+0++"});
+    EXPECT_EQ(static_cast<int32_t>(BT::Number<12>{num_neg_50.view()}), -50);
+
+    // Truncation keeps only the least significant trits
+    EXPECT_EQ(BT::Number<3>{num_neg_50.view()}, BT::Number<3>{"0++"});
+
+    // Fields can be extracted through a slice of the view
+    EXPECT_EQ(BT::Number<8>{num_neg_50.view().slice(3, 2)}, BT::Number<8>{"-+"});
+}
+
+TEST(Number, MixedWidthComparisons) {
+    const BT::Number<4> num_17{"+-0-"};
+    const BT::Number<8> wide_17{"+-0-"};
+    const BT::Number<8> wide_neg_17{"-+0+"};
+
+    EXPECT_EQ(num_17, wide_17);
+    EXPECT_EQ(wide_17, num_17);
+    EXPECT_NE(num_17, wide_neg_17);
+
+    EXPECT_LT(wide_neg_17, num_17);
+    EXPECT_GT(num_17, wide_neg_17);
+    EXPECT_LE(num_17, wide_17);
+    EXPECT_GE(wide_17, num_17);
+}
+
+TEST(Number, MixedWidthBinaryOperations) {
+    const BT::Number<4> num_23{"+0--"};
+    const BT::Number<8> wide_33{"++-0"};
+
+    // Results take the size of the wider operand
+    EXPECT_EQ(num_23 + wide_33, BT::Number<8>{"+-0+-"}); // Sum to 56
+    EXPECT_EQ(wide_33 + num_23, BT::Number<8>{"+-0+-"}); // Sum to 56
+    EXPECT_EQ(num_23 - wide_33, BT::Number<8>{"-0-"}); // Difference is -10
+    EXPECT_EQ(wide_33 - num_23, BT::Number<8>{"+0+"}); // Difference is 10
+
+    // In-place operations accept views of any width
+    auto temp = wide_33;
+    temp += num_23.view();
+    EXPECT_EQ(temp, BT::Number<8>{"+-0+-"}); // Sum to 56
+
+    temp = wide_33;
+    temp -= num_23.view();
+    EXPECT_EQ(temp, BT::Number<8>{"+0+"}); // Difference is 10
+
+    // A wider view is truncated to the size of the number it is added into
+    const BT::Number<8> wide_10{"+0+"};
+    BT::Number<2> narrow_1{"+"};
+    narrow_1 += wide_10.view(); // 10 is truncated to "0+", so 1 + 1 = 2
+    EXPECT_EQ(narrow_1, BT::Number<2>{"+-"});
+}
+
+TEST(Number, IntegerDivisionLargeQuotients) {
+    // Twenty "+" trits is the largest 20-trit value, 1,743,392,200
+    const BT::Number<20> num_max{"++++++++++++++++++++"};
+
+    EXPECT_EQ(num_max / BT::Number<20>{"+"}, num_max);
+    EXPECT_EQ(-num_max / BT::Number<20>{"+"}, -num_max);
+    EXPECT_EQ(static_cast<int32_t>(num_max / BT::Number<20>{"+-"}), 871696100);    // / 2
+    EXPECT_EQ(static_cast<int32_t>(num_max / BT::Number<20>{"-+-"}), -249056028);  // / -7
+    EXPECT_EQ(static_cast<int32_t>(num_max / num_max), 1);
+
+    // A divisor wider than a third of the range exercises the widened remainder
+    const BT::Number<20> num_big{"+-------------------"}; // 581,130,734
+    EXPECT_EQ(static_cast<int32_t>(num_max / num_big), 2);
+    EXPECT_EQ(static_cast<int32_t>(num_big / num_max), 0);
+
+    // Agrees with truncating integer division across the range of 5 trits
+    for (int32_t n = -121; n <= 121; ++n) {
+        for (int32_t d : {-121, -13, -5, -3, -2, -1, 1, 2, 3, 5, 13, 121}) {
+            EXPECT_EQ(static_cast<int32_t>(fromInt<5>(n) / fromInt<5>(d)), n / d) << n << " / " << d;
+        }
+    }
+}
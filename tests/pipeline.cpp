@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "pipeline.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST(BoundedQueue, FirstInFirstOut) {
+    BT::BoundedQueue<int> queue{3};
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+
+    EXPECT_EQ(queue.pop(), 1);
+    EXPECT_EQ(queue.pop(), 2);
+    EXPECT_EQ(queue.pop(), 3);
+}
+
+TEST(BoundedQueue, CloseDrainsRemainingItems) {
+    BT::BoundedQueue<int> queue{2};
+    queue.push(1);
+    queue.close();
+
+    // Items pushed before closing are still handed out, and then nothing
+    EXPECT_EQ(queue.pop(), 1);
+    EXPECT_EQ(queue.pop(), std::nullopt);
+    EXPECT_EQ(queue.pop(), std::nullopt);
+}
+
+TEST(BoundedQueue, CloseReleasesWaitingConsumer) {
+    BT::BoundedQueue<int> queue{1};
+
+    std::optional<int> popped{0};
+    std::jthread consumer{[&] { popped = queue.pop(); }};
+
+    queue.close();
+    consumer.join();
+    EXPECT_EQ(popped, std::nullopt);
+}
+
+TEST(BoundedQueue, PushWaitsWhileFull) {
+    BT::BoundedQueue<int> queue{1};
+    queue.push(1);
+
+    std::atomic<bool> pushed = false;
+    std::jthread producer{[&] {
+        queue.push(2);
+        pushed = true;
+    }};
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(pushed);
+
+    // Making room lets the waiting producer through
+    EXPECT_EQ(queue.pop(), 1);
+    producer.join();
+    EXPECT_TRUE(pushed);
+    EXPECT_EQ(queue.pop(), 2);
+}
+
+TEST(Sequencer, EmptyInput) {
+    BT::Sequencer sequencer{1};
+    sequencer.finish(0);
+
+    EXPECT_EQ(sequencer.next(), std::nullopt);
+}
+
+TEST(Sequencer, OutOfOrderSubmissionsReturnInOrder) {
+    BT::Sequencer sequencer{4};
+    sequencer.submit(2, {"c"});
+    sequencer.submit(0, {"a"});
+    sequencer.submit(3, {"d", "e"});
+    sequencer.submit(1, {"b"});
+    sequencer.finish(4);
+
+    EXPECT_EQ(sequencer.next(), std::vector<std::string>{"a"});
+    EXPECT_EQ(sequencer.next(), std::vector<std::string>{"b"});
+    EXPECT_EQ(sequencer.next(), std::vector<std::string>{"c"});
+    EXPECT_EQ(sequencer.next(), (std::vector<std::string>{"d", "e"}));
+    EXPECT_EQ(sequencer.next(), std::nullopt);
+}
+
+TEST(Sequencer, NextWaitsForMissingBatch) {
+    BT::Sequencer sequencer{2};
+    sequencer.submit(1, {"b"});
+
+    std::optional<std::vector<std::string>> first{};
+    std::jthread writer{[&] { first = sequencer.next(); }};
+
+    // Batch 1 being ready is no use until batch 0 arrives
+    std::this_thread::sleep_for(50ms);
+    sequencer.submit(0, {"a"});
+    writer.join();
+
+    EXPECT_EQ(first, std::vector<std::string>{"a"});
+    EXPECT_EQ(sequencer.next(), std::vector<std::string>{"b"});
+}
+
+TEST(Sequencer, SubmitWaitsOutsideWindow) {
+    BT::Sequencer sequencer{2};
+    sequencer.submit(0, {"a"});
+    sequencer.submit(1, {"b"});
+
+    std::atomic<bool> submitted = false;
+    std::jthread worker{[&] {
+        sequencer.submit(2, {"c"});
+        submitted = true;
+    }};
+
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(submitted);
+
+    // Handing back batch 0 moves the window along to admit batch 2
+    EXPECT_EQ(sequencer.next(), std::vector<std::string>{"a"});
+    worker.join();
+    EXPECT_TRUE(submitted);
+
+    sequencer.finish(3);
+    EXPECT_EQ(sequencer.next(), std::vector<std::string>{"b"});
+    EXPECT_EQ(sequencer.next(), std::vector<std::string>{"c"});
+    EXPECT_EQ(sequencer.next(), std::nullopt);
+}
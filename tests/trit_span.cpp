@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <array>
+
+#include "trit_span.hpp"
+
+namespace {
+    // 17 in balanced ternary, most-significant first
+    constexpr std::array<BT::Trit, 4> trits_17{
+        BT::Trit::POS, BT::Trit::NEG, BT::Trit::ZERO, BT::Trit::NEG
+    };
+}
+
+TEST(TritSpan, EmptySpanIsZero) {
+    const BT::TritSpan empty{};
+
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(empty.tritAt(0), BT::Trit::ZERO);
+    EXPECT_EQ(static_cast<int32_t>(empty), 0);
+}
+
+TEST(TritSpan, TritsReadFromLeastSignificant) {
+    const BT::TritSpan span_17{trits_17};
+
+    EXPECT_EQ(span_17.tritAt(0), BT::Trit::NEG);
+    EXPECT_EQ(span_17.tritAt(1), BT::Trit::ZERO);
+    EXPECT_EQ(span_17.tritAt(2), BT::Trit::NEG);
+    EXPECT_EQ(span_17.tritAt(3), BT::Trit::POS);
+    EXPECT_EQ(static_cast<int32_t>(span_17), 17);
+}
+
+TEST(TritSpan, WideningReadsZeroTrits) {
+    const BT::TritSpan span_17{trits_17};
+
+    EXPECT_EQ(span_17.tritAt(4), BT::Trit::ZERO);
+    EXPECT_EQ(span_17.tritAt(100), BT::Trit::ZERO);
+}
+
+TEST(TritSpan, TruncationAndSlicing) {
+    const BT::TritSpan span_17{trits_17};
+
+    EXPECT_EQ(static_cast<int32_t>(span_17.lowest(2)), -1);  // "0-"
+    EXPECT_EQ(static_cast<int32_t>(span_17.lowest(3)), -10); // "-0-"
+    EXPECT_EQ(span_17.lowest(10).size(), 4);
+
+    EXPECT_EQ(static_cast<int32_t>(span_17.slice(2, 2)), 2); // "+-"
+    EXPECT_EQ(static_cast<int32_t>(span_17.slice(1, 2)), -3); // "-0"
+    EXPECT_EQ(span_17.slice(3, 5).size(), 1);
+    EXPECT_EQ(span_17.slice(4, 1).size(), 0);
+}
+
+TEST(TritSpan, ComparisonsAcrossLengths) {
+    const BT::TritSpan span_17{trits_17};
+    const BT::TritSpan span_neg_1 = span_17.lowest(2);
+    const std::array<BT::Trit, 6> padded_17{
+        BT::Trit::ZERO, BT::Trit::ZERO,
+        BT::Trit::POS, BT::Trit::NEG, BT::Trit::ZERO, BT::Trit::NEG
+    };
+    const BT::TritSpan span_padded_17{padded_17};
+
+    EXPECT_EQ(span_17, span_padded_17);
+    EXPECT_NE(span_17, span_neg_1);
+    EXPECT_LT(span_neg_1, span_17);
+    EXPECT_LT(span_neg_1, BT::TritSpan{});
+    EXPECT_GT(span_padded_17, span_neg_1);
+    EXPECT_GE(span_padded_17, span_17);
+}
+
+TEST(TritSpan, ConversionAtFullWidth) {
+    // Twenty "+" trits is the largest value that fits, (3^20 - 1) / 2
+    std::array<BT::Trit, 20> max_20{};
+    max_20.fill(BT::Trit::POS);
+    EXPECT_EQ(static_cast<int32_t>(BT::TritSpan{max_20}), 1743392200);
+
+    max_20.fill(BT::Trit::NEG);
+    EXPECT_EQ(static_cast<int32_t>(BT::TritSpan{max_20}), -1743392200);
+
+    // Leading zero-trits beyond 20 do not affect the value
+    std::array<BT::Trit, 24> padded_1{};
+    padded_1.back() = BT::Trit::POS;
+    EXPECT_EQ(static_cast<int32_t>(BT::TritSpan{padded_1}), 1);
+}